@@ -1,6 +1,7 @@
 
 #ifdef __APPLE__
-#   define S2N_BN_SYMBOL(NAME) _##NAME
+#   define S2N_BN_CONCAT(A,B) A##B
+#   define S2N_BN_SYMBOL(NAME) S2N_BN_CONCAT(_,NAME)
 #else
 #   define S2N_BN_SYMBOL(name) name
 #endif